@@ -33,8 +33,12 @@
 #include <utility>
 #include <functional>
 #include <atomic>
+#include <thread>
+#include <array>
+#include <limits>
 #include <cassert>
 #include <cmath>
+#include <concepts>
 
 namespace fm::profiling {
 
@@ -50,17 +54,92 @@ namespace fm::profiling {
     constexpr bool TimerStats{false};
 #endif
 
+#ifdef TIMER_BUDGETS
+    constexpr bool TimerBudgets{true};
+#else
+    constexpr bool TimerBudgets{false};
+#endif
+
+#ifdef TIMER_FOLD_RECURSION
+    constexpr bool TimerFoldRecursion{true};
+#else
+    constexpr bool TimerFoldRecursion{false};
+#endif
+
+#ifdef TIMER_MAX_LABELS
+    constexpr size_t TimerMaxLabels{TIMER_MAX_LABELS};
+#else
+    constexpr size_t TimerMaxLabels{std::numeric_limits<size_t>::max()};
+#endif
+
+#ifdef TIMER_EXEMPLARS
+    constexpr unsigned TimerExemplars{TIMER_EXEMPLARS};
+    static_assert(TimerExemplars > 0, "TIMER_EXEMPLARS must be a positive count of exemplars");
+#else
+    constexpr unsigned TimerExemplars{0};
+#endif
+
+    // exemplar of a slow call
+    template <typename R = double>
+    struct TimeExemplar
+    {
+        std::chrono::duration<R> _duration; // call duration
+        std::chrono::duration<R> _start;    // call start, relative to timers origin
+        unsigned _thread;                   // index of calling thread
+        std::string _tag;                   // user supplied tag, e.g. a request ID
+
+        // order exemplars so that heap front is the fastest of the slowest calls
+        friend bool operator<(const TimeExemplar &a, const TimeExemplar &b)
+        {
+            return a._duration > b._duration;
+        }
+    };
+
+    // push exemplar into bounded min-heap of the TimerExemplars slowest calls
+    template <typename E>
+    void push_exemplar(std::vector<E> &a_heap, E &&a_exemplar)
+    {
+        if (a_heap.size() < TimerExemplars)
+        {
+            a_heap.push_back(std::move(a_exemplar));
+            std::push_heap(a_heap.begin(), a_heap.end());
+        }
+        else if (a_exemplar._duration > a_heap.front()._duration)
+        {
+            std::pop_heap(a_heap.begin(), a_heap.end());
+            a_heap.back() = std::move(a_exemplar);
+            std::push_heap(a_heap.begin(), a_heap.end());
+        }
+    }
+
     // time record
     template <typename I = size_t, typename R = double>
     struct TimeRecord
     {
         I _count;                           // number of calls
         std::chrono::duration<R> _duration; // calls duration
+        struct
+        {
+            I _items, _bytes;
+        } _work{};                          // work processed by calls
 #ifdef TIMER_STATS
         struct
         {
             R _rms, _max;
         } _stats{};
+#endif
+#ifdef TIMER_BUDGETS
+        I _overruns;                        // number of calls over budget
+#endif
+#ifdef TIMER_FOLD_RECURSION
+        struct
+        {
+            I _open;                        // currently open folded calls
+            std::vector<I> _calls;          // folded calls by recursion depth - 1
+        } _recursion{};
+#endif
+#ifdef TIMER_EXEMPLARS
+        std::vector<TimeExemplar<R>> _exemplars; // slowest calls
 #endif
     };
 
@@ -85,6 +164,108 @@ namespace fm::profiling {
     template <typename T>
     using register_record_t = typename time_register_type_traits<T>::record_t;
 
+    // overrun of a scope budget
+    template <typename Label, typename Duration>
+    struct OverrunEvent
+    {
+        const Label *_scope; // scope label, owned by the register
+        Duration _elapsed;   // time spent in scope when overrun was detected
+        Duration _budget;    // scope budget
+        unsigned _thread;    // index of thread running the scope
+        bool _open;          // scope was still open, i.e. detected by the watchdog
+    };
+
+#ifdef TIMER_BUDGETS
+    // Budgeted scopes report overruns as compact events into a bounded lock-free queue, which
+    // the application drains at its own pace. Overruns are detected by the Timer destructor or,
+    // for scopes still open past their budget, by an optional watchdog thread which scans a
+    // fixed table of watch slots claimed by budgeted Timers. Each slot is guarded by a sequence
+    // counter, odd while the slot is being written, so the watchdog never reports a torn slot.
+
+    // bounded multi-producer multi-consumer lock-free queue (after D. Vyukov)
+    template <typename T, size_t N = 1024>
+    class LockFreeQueue
+    {
+        static_assert(N > 1 && (N & (N - 1)) == 0, "queue capacity must be a power of 2");
+
+        struct cell
+        {
+            std::atomic<size_t> _seq;
+            T _data;
+        };
+        std::array<cell, N> _cells;
+        alignas(64) std::atomic<size_t> _head{0};
+        alignas(64) std::atomic<size_t> _tail{0};
+
+    public:
+        LockFreeQueue()
+        {
+            for (size_t i{0}; i < N; ++i)
+                _cells[i]._seq.store(i, std::memory_order_relaxed);
+        }
+
+        // push an item, return false if queue is full
+        bool push(const T &a_item)
+        {
+            auto pos = _tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto &c = _cells[pos & (N - 1)];
+                const auto dif = static_cast<std::ptrdiff_t>(c._seq.load(std::memory_order_acquire) - pos);
+                if (dif == 0)
+                {
+                    if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c._data = a_item;
+                        c._seq.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (dif < 0)
+                    return false;
+                else
+                    pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        // pop an item, return false if queue is empty
+        bool pop(T &a_item)
+        {
+            auto pos = _head.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto &c = _cells[pos & (N - 1)];
+                const auto dif = static_cast<std::ptrdiff_t>(c._seq.load(std::memory_order_acquire) - (pos + 1));
+                if (dif == 0)
+                {
+                    if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        a_item = c._data;
+                        c._seq.store(pos + N, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (dif < 0)
+                    return false;
+                else
+                    pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // slot publishing an open budgeted scope to the watchdog
+    template <typename Label, typename Rep>
+    struct WatchSlot
+    {
+        std::atomic_flag _taken = ATOMIC_FLAG_INIT; // claimed by a Timer
+        std::atomic<unsigned> _seq{0};              // odd while slot is being written
+        std::atomic<const Label *> _scope{nullptr};
+        std::atomic<Rep> _t_up{0}, _budget{0};
+        std::atomic<unsigned> _thread{0};
+        unsigned _reported_seq{0};                  // watchdog only
+    };
+#endif
+
 #ifdef MULTI_THREAD
     // In multithread case, different threads write conncurrently to a pool of Registers,
     // arranged in a static array. Threads' access to Registers is controlled by AtomicGates
@@ -171,6 +352,195 @@ namespace fm::profiling {
     using AtomicGates = void;
 #endif
 
+    // Alternatively to per-thread Registers, all threads can write to a single process-wide
+    // SharedTimeRegister. An AtomicInterner maps each label, lock-free, to a dense scope ID, which
+    // indexes a table of cache line padded atomic counters updated with fetch_add. Counters of
+    // heavily hit scopes are striped across threads to limit cache line contention. There is
+    // nothing to consolidate and a printout is always current, so this mode suits applications
+    // with many short-lived threads, which would otherwise leave mostly empty Registers behind.
+    // Labels beyond the table capacity are recorded in an overflow entry.
+
+    // wait-free (except for concurrent first insertion of a label) interning of labels into IDs
+    template <typename Label = std::string, size_t Capacity = 4096, typename Hash = std::hash<Label>>
+    struct AtomicInterner
+    {
+        static constexpr size_t capacity{Capacity};
+
+        // return ID of a_label, inserting it if needed: Capacity is the ID of the overflow entry
+        static size_t intern(const Label &a_label)
+        {
+            const auto hash = Hash{}(a_label) | 1;
+            for (size_t i{0}, idx{hash}; i < _slots.size(); ++i, ++idx)
+            {
+                auto &slot = _slots[idx % _slots.size()];
+                auto slot_hash = slot._hash.load(std::memory_order_acquire);
+
+                // empty slot: label is new, once all IDs are taken it goes to overflow without claiming the slot
+                if (slot_hash == 0 && _size.load(std::memory_order_relaxed) >= Capacity)
+                    return Capacity;
+
+                // empty slot: claim it and assign next ID to the label, or overflow if IDs ran out meanwhile
+                if (slot_hash == 0 && slot._hash.compare_exchange_strong(slot_hash, hash, std::memory_order_acq_rel))
+                {
+                    slot._label = a_label;
+                    auto sid = _size.load(std::memory_order_relaxed);
+                    while (sid < Capacity && !_size.compare_exchange_weak(sid, sid + 1, std::memory_order_relaxed))
+                        ;
+                    if (sid < Capacity)
+                        _labels[sid].store(&slot._label, std::memory_order_release);
+                    else
+                        sid = Capacity;
+                    slot._sid.store(sid, std::memory_order_release);
+                    return sid;
+                }
+
+                // same hash: wait for the label to be published and compare
+                if (slot_hash == hash)
+                {
+                    auto sid = slot._sid.load(std::memory_order_acquire);
+                    while (sid == unassigned)
+                    {
+                        std::this_thread::yield();
+                        sid = slot._sid.load(std::memory_order_acquire);
+                    }
+                    if (slot._label == a_label)
+                        return sid;
+                }
+            }
+            return Capacity;
+        }
+
+        // label of interned ID, nullptr if not yet published
+        static const Label *label(const size_t a_sid)
+        {
+            return a_sid < Capacity ? _labels[a_sid].load(std::memory_order_acquire) : &_overflow_label;
+        }
+
+        // count of IDs in use, excluding overflow
+        static size_t size()
+        {
+            return _size.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr size_t unassigned{std::numeric_limits<size_t>::max()};
+
+        struct slot
+        {
+            std::atomic<size_t> _hash{0}; // 0 for empty slot
+            std::atomic<size_t> _sid{unassigned};
+            Label _label;
+        };
+
+        // open addressing table kept at load factor <= 50%
+        static std::array<slot, 2 * Capacity> _slots;
+        static std::array<std::atomic<const Label *>, Capacity> _labels;
+        static std::atomic<size_t> _size;
+        static const Label _overflow_label;
+    };
+
+    // process-wide register of atomic counters indexed by the IDs of an AtomicInterner
+    template <typename Record = TimeRecord<>, size_t Capacity = 4096, unsigned Stripes = 8>
+    class SharedTimeRegister
+    {
+        // counters are striped once a scope reaches HotCount calls
+        static constexpr size_t HotCount{1024};
+
+        struct alignas(64) counters
+        {
+            std::atomic<size_t> _count{0};
+            std::atomic<std::chrono::nanoseconds::rep> _duration{0};
+            std::atomic<size_t> _items{0}, _bytes{0}, _overruns{0};
+        };
+
+        struct entry
+        {
+            counters _counters;
+            std::atomic<counters *> _stripes{nullptr};
+        };
+
+        // one entry per ID plus overflow entry
+        std::array<entry, Capacity + 1> _entries;
+
+        // sequential thread striping
+        static std::atomic<unsigned> _thread_count;
+        thread_local static unsigned _stripe;
+
+    public:
+        using record_t = Record;
+        static constexpr size_t capacity{Capacity};
+
+        SharedTimeRegister() = default;
+        SharedTimeRegister(const SharedTimeRegister &) = delete;
+        SharedTimeRegister &operator=(const SharedTimeRegister &) = delete;
+
+        ~SharedTimeRegister()
+        {
+            for (auto &e : _entries)
+                delete[] e._stripes.load(std::memory_order_acquire);
+        }
+
+        // record a call to scope a_sid: calls nested in an enclosing call of the same scope,
+        // which accounts for their count and duration, only add work and overruns
+        void update(const size_t a_sid, const std::chrono::nanoseconds a_dt,
+                    const size_t a_items, const size_t a_bytes, const bool a_overrun, const bool a_nested = false)
+        {
+            auto &e = _entries[a_sid];
+            auto *c = e._stripes.load(std::memory_order_acquire);
+            c = c ? c + _stripe : &e._counters;
+
+            size_t count{0};
+            if (!a_nested)
+            {
+                count = c->_count.fetch_add(1, std::memory_order_relaxed) + 1;
+                c->_duration.fetch_add(a_dt.count(), std::memory_order_relaxed);
+            }
+            if (a_items > 0)
+                c->_items.fetch_add(a_items, std::memory_order_relaxed);
+            if (a_bytes > 0)
+                c->_bytes.fetch_add(a_bytes, std::memory_order_relaxed);
+            if (a_overrun)
+                c->_overruns.fetch_add(1, std::memory_order_relaxed);
+
+            // only one call sees the unstriped counter reach HotCount
+            if (c == &e._counters && count == HotCount)
+                e._stripes.store(new counters[Stripes], std::memory_order_release);
+        }
+
+        // current record of scope a_sid, summed over stripes
+        Record record(const size_t a_sid) const
+        {
+            const auto &e = _entries[a_sid];
+            Record rec{};
+            auto add = [&rec](const counters &c) {
+                rec._count += c._count.load(std::memory_order_relaxed);
+                rec._duration += std::chrono::nanoseconds(c._duration.load(std::memory_order_relaxed));
+                rec._work._items += c._items.load(std::memory_order_relaxed);
+                rec._work._bytes += c._bytes.load(std::memory_order_relaxed);
+                if constexpr (TimerBudgets)
+                    rec._overruns += c._overruns.load(std::memory_order_relaxed);
+            };
+            add(e._counters);
+            if (const auto *stripes = e._stripes.load(std::memory_order_acquire))
+                std::for_each(stripes, stripes + Stripes, add);
+            return rec;
+        }
+    };
+
+    // shared register type traits
+    template <typename T>
+    struct is_shared_register : std::false_type {};
+
+    template <typename R, size_t C, unsigned S>
+    struct is_shared_register<SharedTimeRegister<R, C, S>> : std::true_type {};
+
+    template <typename R, size_t C, unsigned S>
+    struct time_register_type_traits<SharedTimeRegister<R, C, S>>
+    {
+        using record_t = R;
+        using label_t = std::string;
+    };
+
     // use granulrity param to define when timer is onduty 
     constexpr bool OnDuty(const unsigned g) {return g<TimerGranularityLim;}
 
@@ -183,11 +553,27 @@ namespace fm::profiling {
               typename AtomicMapper=AtomicGates<>>
     using Timer_t = Timer<OnDuty(Granularity),Register,Clock,AtomicMapper>;
 
+    // Timer writing to the process-wide shared register
+    template <unsigned Granularity=1,
+              typename Clock=std::chrono::steady_clock>
+    using SharedTimer_t = Timer_t<Granularity,SharedTimeRegister<>,Clock,AtomicInterner<>>;
+
     // default timer does nothing because it is off duty
     template <bool B, typename R, typename C, typename A>
     struct Timer
     {
         Timer(std::string &&) {}
+        Timer(std::string &&, std::string) {}
+        template <std::integral I, std::integral J = size_t>
+        Timer(std::string &&, const I, const J = 0) {}
+        template <typename Rep, typename Period>
+        Timer(std::string &&, const std::chrono::duration<Rep, Period>) {}
+        using overrun_event_t = OverrunEvent<register_label_t<R>, typename C::duration>;
+        static void start_watchdog(const auto) {}
+        static void stop_watchdog() {}
+        static bool pop_overrun(overrun_event_t &) { return false; }
+        static void print_overruns(std::ostream& =std::cout) {}
+        void add_work(const size_t, const size_t = 0) {}
         void stop() {}
         static void print_record(std::ostream& os=std::cout, std::function<void()> x={}) {}
         ~Timer() {}
@@ -196,6 +582,18 @@ namespace fm::profiling {
     template <typename Register, typename Clock, typename AtomicMapper>
     class Timer<true, Register, Clock, AtomicMapper>
     {
+        // all threads write to a single shared register
+        static constexpr bool SharedMode{is_shared_register<Register>::value};
+
+        // registers with a cap on labels, past which calls are recorded in overflow entries
+        static constexpr bool LabelCap{SharedMode || TimerMaxLabels < std::numeric_limits<size_t>::max()};
+        static_assert(!SharedMode || (!TimerStats && TimerExemplars == 0 && !TimerFoldRecursion),
+                      "shared register records neither stats, exemplars nor recursion");
+
+        // map based register records are printed from
+        using record_register_t = TimeRegister<register_record_t<Register>, register_label_t<Register>>;
+
+        static Register _register;
 #ifdef MULTI_THREAD
         // measurementes are stored in stratic registers;
         static std::vector<Register> _registers;
@@ -206,45 +604,328 @@ namespace fm::profiling {
         // thread local static variables
         thread_local static unsigned _register_gate;
         thread_local static unsigned _thread_timer_cnt;
-#else
-        static Register _register;
+
+        // sequential thread indexing, used to identify threads in exemplars and overruns
+        static std::atomic<unsigned> _thread_count;
+        thread_local static unsigned _thread_index;
 #endif
         // Label tracking call sequence
         thread_local static register_label_t<Register> _call_sequence;
 
+        // label segment of entries collecting calls to labels beyond TimerMaxLabels
+        static const register_label_t<Register> _overflow_label;
+
+        // reference time for exemplars start times
+        static const std::chrono::time_point<Clock> _t_origin;
+
+    public:
+        using overrun_event_t = OverrunEvent<register_label_t<Register>, typename Clock::duration>;
+
+    private:
+#ifdef TIMER_BUDGETS
+        // overrun events and count of events lost to a full queue
+        static LockFreeQueue<overrun_event_t> _overruns;
+        static std::atomic<size_t> _overruns_lost;
+
+        // open budgeted scopes watched by the watchdog thread
+        static constexpr unsigned WatchSlotCount{64};
+        static std::array<WatchSlot<register_label_t<Register>, typename Clock::rep>, WatchSlotCount> _watch_slots;
+        static std::jthread _watchdog;
+#endif
+
         // member data
         size_t _prev_sequence_size;
         std::chrono::time_point<Clock> _t_up;
         typename Clock::duration _dt;
+        size_t _items{0}, _bytes{0};
+        // ID of the scope in the shared register
+        size_t _scope_id{0};
+#ifdef TIMER_BUDGETS
+        typename Clock::duration _budget{Clock::duration::zero()};
+        int _watch_slot{-1};
+#endif
+#ifdef TIMER_EXEMPLARS
+        std::string _tag;
+#endif
+#ifdef TIMER_FOLD_RECURSION
+        // recursion depth of a folded call, 0 if not folded
+        unsigned _fold_depth{0};
+#endif
+        // call nested in an overflow entry
+        bool _in_overflow{false};
 
         // print out measurements
         static void print_record(const register_label_t<Register> a_record_label,
                                  const register_record_t<Register> &a_record,
-                                 const Register &a_register,
+                                 const record_register_t &a_register,
                                  const unsigned a_level,
                                  std::ostream &a_ostream);
 
+        // register of calling thread
+        static Register &thread_register()
+        {
+#ifdef MULTI_THREAD
+            return _registers[_register_gate];
+#else
+            return _register;
+#endif
+        }
+
+        // warn about calls which could not be recorded under their own label
+        static void print_overflow(const record_register_t &a_register, std::ostream &a_ostream)
+        {
+            if constexpr (LabelCap)
+            {
+                register_record_t<Register> overflow{};
+                for (const auto &[label, rec] : a_register)
+                {
+                    if (label.ends_with(_overflow_label))
+                    {
+                        overflow._count += rec._count;
+                        overflow._duration += rec._duration;
+                    }
+                }
+                if (overflow._count > 0)
+                {
+                    size_t label_cap{TimerMaxLabels};
+                    if constexpr (SharedMode)
+                        label_cap = Register::capacity;
+                    a_ostream << "warning: register label cap of " << label_cap << " reached, "
+                              << overflow._count << " calls taking " << std::scientific << std::setprecision(3)
+                              << overflow._duration.count() << " s recorded in " << _overflow_label.substr(1)
+                              << " entries\n";
+                }
+            }
+        }
+
+        // register entry of current call sequence
+        static auto &register_entry()
+        {
+            return *thread_register().try_emplace(_call_sequence).first;
+        }
+
+        // reserve register entry of a new scope, so that parents always precede their children,
+        // or once the register is full redirect the scope to the overflow entry of its parent:
+        // the shared register has a single overflow entry, but the sequence is redirected alike
+        // so that nested calls are still recognised as such
+        void reserve_entry()
+        {
+            if constexpr (SharedMode)
+            {
+                if (_scope_id = AtomicMapper::intern(_call_sequence); _scope_id == Register::capacity)
+                {
+                    _call_sequence.resize(_prev_sequence_size);
+                    _call_sequence.append(_overflow_label);
+                }
+            }
+            else
+            {
+                auto &reg = thread_register();
+                if (reg.size() < TimerMaxLabels)
+                    reg.try_emplace(_call_sequence);
+                else if (!reg.contains(_call_sequence))
+                {
+                    _call_sequence.resize(_prev_sequence_size);
+                    _call_sequence.append(_overflow_label);
+                    reg.try_emplace(_call_sequence);
+                }
+            }
+        }
+
+        // true for calls accounted for by an enclosing call of the same register entry:
+        // folded recursive calls and calls nested in an overflow entry
+        bool is_nested_call() const
+        {
+            bool nested{false};
+#ifdef TIMER_FOLD_RECURSION
+            nested = nested || _fold_depth > 0;
+#endif
+            nested = nested || _in_overflow;
+            return nested;
+        }
+
+        // label of current call sequence as stored in the register
+        const register_label_t<Register> *scope_label() const
+        {
+            if constexpr (SharedMode)
+                return AtomicMapper::label(_scope_id);
+            else
+                return &register_entry().first;
+        }
+
+        // true if a_name is the last segment of the call sequence, i.e. a direct recursive call
+        static bool is_last_segment(const std::string &a_name)
+        {
+            const auto n = a_name.size();
+            const auto size = _call_sequence.size();
+            return size > n && _call_sequence[size - n - 1] == '/' && _call_sequence.compare(size - n, n, a_name) == 0;
+        }
+
+        // index of calling thread
+        static unsigned thread_index()
+        {
+#ifdef MULTI_THREAD
+            return _thread_index;
+#else
+            return 0;
+#endif
+        }
+
+#ifdef TIMER_BUDGETS
+        // release watch slot and check budget of a budgeted scope
+        bool over_budget()
+        {
+            if (_budget == Clock::duration::zero())
+                return false;
+
+            if (_watch_slot >= 0)
+            {
+                auto &slot = _watch_slots[_watch_slot];
+                write_watch_slot(slot, [&slot]() { slot._scope.store(nullptr, std::memory_order_relaxed); });
+                slot._taken.clear(std::memory_order_release);
+            }
+            return _dt > _budget;
+        }
+
+        // queue overrun event, or count it as lost if queue is full
+        static void report_overrun(const overrun_event_t &a_event)
+        {
+            if (!_overruns.push(a_event))
+                _overruns_lost.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // seqlock-style update of a watch slot
+        template <typename F>
+        static void write_watch_slot(auto &a_slot, F &&a_write)
+        {
+            a_slot._seq.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            a_write();
+            a_slot._seq.fetch_add(1, std::memory_order_release);
+        }
+
+        // report open scopes which exceeded their budget, once per scope
+        static void check_watch_slots()
+        {
+            const auto now = Clock::now().time_since_epoch().count();
+            for (auto &slot : _watch_slots)
+            {
+                const auto seq = slot._seq.load(std::memory_order_acquire);
+                if (seq % 2 == 1 || seq == slot._reported_seq)
+                    continue;
+
+                const auto scope = slot._scope.load(std::memory_order_relaxed);
+                const auto t_up = slot._t_up.load(std::memory_order_relaxed);
+                const auto budget = slot._budget.load(std::memory_order_relaxed);
+                const auto thread = slot._thread.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (scope == nullptr || slot._seq.load(std::memory_order_relaxed) != seq || now - t_up <= budget)
+                    continue;
+
+                slot._reported_seq = seq;
+                report_overrun({scope, typename Clock::duration{now - t_up}, typename Clock::duration{budget}, thread, true});
+            }
+        }
+#endif
+
     public:
         // constructor
         Timer(std::string &&a_name)
             : _dt{Clock::duration::zero()}, _prev_sequence_size(_call_sequence.size())
         {
 #ifdef MULTI_THREAD
-            // first thread timer opens gate to a register
-            if (_thread_timer_cnt == 0)
-                _register_gate = _gates_keeper.lock_gate(std::this_thread::get_id());
+            if constexpr (!SharedMode)
+            {
+                // first thread timer opens gate to a register
+                if (_thread_timer_cnt == 0)
+                    _register_gate = _gates_keeper.lock_gate(std::this_thread::get_id());
 
-            // count timers in this thread
-            ++_thread_timer_cnt;
+                // count timers in this thread
+                ++_thread_timer_cnt;
+            }
 #endif
-            // update (thread's) Timers sequence
-            _call_sequence.push_back('/');
-            _call_sequence.append(a_name);
+            // calls nested in an overflow entry are recorded by it, leaving sequence as is
+            if (LabelCap && _call_sequence.ends_with(_overflow_label))
+            {
+                _in_overflow = true;
+                if constexpr (SharedMode)
+                    _scope_id = Register::capacity;
+            }
+            else
+#ifdef TIMER_FOLD_RECURSION
+            // fold direct recursive calls into the node of the outermost call, leaving sequence as is
+            if (is_last_segment(a_name))
+                _fold_depth = ++register_entry().second._recursion._open;
+            else
+#endif
+            {
+                // update (thread's) Timers sequence
+                _call_sequence.push_back('/');
+                _call_sequence.append(a_name);
+                if constexpr (LabelCap)
+                    reserve_entry();
+            }
 
             // timer starts
             _t_up = Clock::now();
         }
 
+        // constructor with a tag identifying this call in the exemplars
+        Timer(std::string &&a_name, [[maybe_unused]] std::string a_tag)
+            : Timer(std::move(a_name))
+        {
+#ifdef TIMER_EXEMPLARS
+            _tag = std::move(a_tag);
+#endif
+        }
+
+        // constructor with work quantities processed in the timed scope: any integral
+        // type is taken, so that brace initialization from e.g. an int does not narrow
+        template <std::integral I, std::integral J = size_t>
+        Timer(std::string &&a_name, const I a_items, const J a_bytes = 0)
+            : Timer(std::move(a_name))
+        {
+            add_work(static_cast<size_t>(a_items), static_cast<size_t>(a_bytes));
+        }
+
+        // constructor with a time budget: calls exceeding it are reported as overruns
+        template <typename Rep, typename Period>
+        Timer(std::string &&a_name, [[maybe_unused]] const std::chrono::duration<Rep, Period> a_budget)
+            : Timer(std::move(a_name))
+        {
+#ifdef TIMER_BUDGETS
+            _budget = std::chrono::duration_cast<typename Clock::duration>(a_budget);
+
+            // publish scope to the watchdog, if a watch slot is free
+            const auto t_id = thread_index();
+            for (unsigned i{0}; i < WatchSlotCount; ++i)
+            {
+                const auto sid = (t_id + i) % WatchSlotCount;
+                if (auto &slot = _watch_slots[sid]; !slot._taken.test_and_set(std::memory_order_acquire))
+                {
+                    const auto scope = scope_label();
+                    _t_up = Clock::now();
+                    write_watch_slot(slot, [&]() {
+                        slot._scope.store(scope, std::memory_order_relaxed);
+                        slot._t_up.store(_t_up.time_since_epoch().count(), std::memory_order_relaxed);
+                        slot._budget.store(_budget.count(), std::memory_order_relaxed);
+                        slot._thread.store(t_id, std::memory_order_relaxed);
+                    });
+                    _watch_slot = sid;
+                    break;
+                }
+            }
+#endif
+        }
+
+        // add work processed in the timed scope: must be called before stop()
+        void add_work(const size_t a_items, const size_t a_bytes = 0)
+        {
+            _items += a_items;
+            _bytes += a_bytes;
+        }
+
         // record measurement at destruction unless stop() was already called
         ~Timer()
         {
@@ -252,22 +933,70 @@ namespace fm::profiling {
             {
                 _dt = Clock::now() - _t_up;
 
-                // get the record...
-#ifdef MULTI_THREAD
-                auto &record = _registers[_register_gate][_call_sequence];
-#else
-                auto &record = _register[_call_sequence];
+                if constexpr (SharedMode)
+                {
+                    static_assert(Register::capacity == AtomicMapper::capacity,
+                                  "shared register and interner capacities differ");
+
+                    // update the shared register counters straight away
+                    bool overrun{false};
+#ifdef TIMER_BUDGETS
+                    if (overrun = over_budget(); overrun)
+                        report_overrun({AtomicMapper::label(_scope_id), _dt, _budget, thread_index(), false});
 #endif
-                // ... update it
-                ++record._count;
-                record._duration += _dt;
-
-                if constexpr (TimerStats)
+                    _register.update(_scope_id, std::chrono::duration_cast<std::chrono::nanoseconds>(_dt), _items, _bytes, overrun,
+                                     is_nested_call());
+                }
+                else
                 {
-                    auto &[t_rms, t_max] = record._stats;
-                    const auto dt = _dt.count();
-                    t_rms += dt * dt;
-                    t_max = std::max(t_max, dt);
+                    // get the record...
+                    auto &[label, record] = register_entry();
+
+                    // ... update it
+#ifdef TIMER_FOLD_RECURSION
+                    // folded calls are only counted by recursion depth
+                    if (_fold_depth > 0)
+                    {
+                        auto &[open, calls] = record._recursion;
+                        --open;
+                        if (calls.size() < _fold_depth)
+                            calls.resize(_fold_depth);
+                        ++calls[_fold_depth - 1];
+                    }
+#endif
+                    // nested calls are accounted for by the enclosing call's count and duration
+                    if (!is_nested_call())
+                    {
+                        ++record._count;
+                        record._duration += _dt;
+
+                        if constexpr (TimerStats)
+                        {
+                            auto &[t_rms, t_max] = record._stats;
+                            const auto dt = _dt.count();
+                            t_rms += dt * dt;
+                            t_max = std::max(t_max, dt);
+                        }
+
+#ifdef TIMER_EXEMPLARS
+                        // only calls slower than the current K-th slowest pay the insertion
+                        if (auto &heap = record._exemplars; heap.size() < TimerExemplars || _dt > heap.front()._duration)
+                        {
+                            push_exemplar(heap, {_dt, _t_up - _t_origin, thread_index(), std::move(_tag)});
+                        }
+#endif
+                    }
+                    record._work._items += _items;
+                    record._work._bytes += _bytes;
+
+#ifdef TIMER_BUDGETS
+                    // budget checks only for budgeted scopes
+                    if (over_budget())
+                    {
+                        ++record._overruns;
+                        report_overrun({&label, _dt, _budget, thread_index(), false});
+                    }
+#endif
                 }
 
                 // restore sequence
@@ -275,8 +1004,11 @@ namespace fm::profiling {
 
 #ifdef MULTI_THREAD
                 // final book-keeping: free gate if this thread no more uses it
-                if (--_thread_timer_cnt == 0)
-                    _gates_keeper.free_gate(_register_gate);
+                if constexpr (!SharedMode)
+                {
+                    if (--_thread_timer_cnt == 0)
+                        _gates_keeper.free_gate(_register_gate);
+                }
 #endif
             }
         }
@@ -289,24 +1021,79 @@ namespace fm::profiling {
             this->~Timer();
         }
 
+#ifdef TIMER_BUDGETS
+        // start watchdog thread checking every a_period for open scopes past their budget
+        static void start_watchdog(const auto a_period)
+        {
+            assert(!_watchdog.joinable());
+            _watchdog = std::jthread([a_period](std::stop_token a_stop) {
+                while (!a_stop.stop_requested())
+                {
+                    check_watch_slots();
+                    std::this_thread::sleep_for(a_period);
+                }
+            });
+        }
+
+        // stop and join watchdog thread
+        static void stop_watchdog()
+        {
+            _watchdog = std::jthread{};
+        }
+
+        // pop oldest overrun event, return false if there are none
+        static bool pop_overrun(overrun_event_t &a_event)
+        {
+            return _overruns.pop(a_event);
+        }
+
+        // drain overrun events and print them out
+        static void print_overruns(std::ostream &a_ostream = std::cout)
+        {
+            overrun_event_t event;
+            while (pop_overrun(event))
+            {
+                using dsec = std::chrono::duration<double>;
+                a_ostream << (event._open ? "open scope " : "scope ") << *event._scope << " over budget: "
+                          << std::scientific << std::setprecision(3) << dsec(event._elapsed).count() << " s > "
+                          << dsec(event._budget).count() << " s, thread: " << event._thread << "\n";
+            }
+            if (const auto lost = _overruns_lost.exchange(0, std::memory_order_relaxed); lost > 0)
+                a_ostream << lost << " overrun events lost to full queue\n";
+        }
+#else
+        // without budgets there are no overruns
+        static void start_watchdog(const auto) {}
+        static void stop_watchdog() {}
+        static bool pop_overrun(overrun_event_t &) { return false; }
+        static void print_overruns(std::ostream & = std::cout) {}
+#endif
+
 #ifdef MULTI_THREAD
         // thread count is not used except for setting the register count
         static void set_thread_count(const auto a_thread_count)
         {
-            assert(a_thread_count > 0 && _registers.size() == 0);
+            // shared register serves any number of threads
+            if constexpr (!SharedMode)
+            {
+                assert(a_thread_count > 0 && _registers.size() == 0);
 
-            // initialize keeper and get register count = gate count
-            const auto register_count = AtomicMapper::setup_gates(a_thread_count);
+                // initialize keeper and get register count = gate count
+                const auto register_count = AtomicMapper::setup_gates(a_thread_count);
 
-            // resize register
-            _registers.resize(register_count);
+                // resize register
+                _registers.resize(register_count);
+            }
         };
 
         // consolidate threads records into single printable record:
         // this function may need differerntiate depending on application, so there will be
         // a default version and the possibility for the user to override it.
-        static struct
+        inline static struct
         {
+            // nothing to consolidate in shared register
+            void operator()() {}
+
             void operator()(auto &a_register, auto a_all_registers)
             {
                 const auto first{std::begin(a_all_registers)};
@@ -319,7 +1106,7 @@ namespace fm::profiling {
                 for (auto r_it{first}; r_it != last; ++r_it)
                 {
                     // for each record...
-                    for (auto [label, record] : *r_it)
+                    for (auto &[label, record] : *r_it)
                     {
                         // search for same record-labels in successive records
                         for (auto th_rit{r_it + 1}; th_rit != last; ++th_rit)
@@ -330,11 +1117,28 @@ namespace fm::profiling {
                                 const auto &th_record = th_node.mapped();
                                 record._count += th_record._count;
                                 record._duration += th_record._duration;
+                                record._work._items += th_record._work._items;
+                                record._work._bytes += th_record._work._bytes;
+                                if constexpr (TimerBudgets)
+                                    record._overruns += th_record._overruns;
+                                if constexpr (TimerFoldRecursion)
+                                {
+                                    auto &calls = record._recursion._calls;
+                                    const auto &th_calls = th_record._recursion._calls;
+                                    if (calls.size() < th_calls.size())
+                                        calls.resize(th_calls.size());
+                                    std::transform(th_calls.cbegin(), th_calls.cend(), calls.cbegin(), calls.begin(), std::plus<>{});
+                                }
                                 if constexpr (TimerStats)
                                 {
                                     record._stats._rms += th_record._stats._rms;
                                     record._stats._max += (record._stats._max, th_record._stats._max);
                                 }
+                                if constexpr (TimerExemplars > 0)
+                                {
+                                    for (auto xmp : th_record._exemplars)
+                                        push_exemplar(record._exemplars, std::move(xmp));
+                                }
                             }
                         }
                     }
@@ -343,9 +1147,10 @@ namespace fm::profiling {
                 }
             }
         } _consolidate;
-        using f_consolidate_t=std::function<void(Register&,std::vector<Register>)>;
+        using f_consolidate_t = std::conditional_t<SharedMode, std::function<void()>,
+                                                   std::function<void(Register &, std::vector<Register>)>>;
 #else
-        static struct
+        inline static struct
         {
             void operator()() {}
         } _consolidate;
@@ -355,39 +1160,64 @@ namespace fm::profiling {
         // print out measurements
         static void print_record(std::ostream &a_ostream = std::cout, f_consolidate_t a_consolidate_records = _consolidate)
         {
+            if constexpr (SharedMode)
+            {
+                // shared register is always current: print out a snapshot of its counters
+                record_register_t full_record{};
+                for (size_t sid{0}; sid < AtomicMapper::size(); ++sid)
+                {
+                    if (const auto label = AtomicMapper::label(sid))
+                        full_record.try_emplace(*label, _register.record(sid));
+                }
+                if (const auto overflow = _register.record(Register::capacity); overflow._count > 0)
+                    full_record.try_emplace(_overflow_label, overflow);
+
+                print_overflow(full_record, a_ostream);
+                print_record("/", {}, full_record, 0, a_ostream);
+            }
+            else
+            {
 #ifndef MULTI_THREAD
-            // now print out records
-            print_record("/", {}, _register, 0, a_ostream);
+                // now print out records
+                print_overflow(_register, a_ostream);
+                print_record("/", {}, _register, 0, a_ostream);
 #else
-            // freeze access to registers during print out
-            // this implies waiting till all Timers are done recording
-            AtomicMapper::lock_all_gates();
+                // freeze access to registers during print out
+                // this implies waiting till all Timers are done recording
+                AtomicMapper::lock_all_gates();
 
-            // use a_consolidate input function to consolidate thread's records
-            Register full_record{};
-            a_consolidate_records(full_record, _registers);
+                // use a_consolidate input function to consolidate thread's records
+                Register full_record{};
+                a_consolidate_records(full_record, _registers);
 
-            // now print out records
-            print_record("/", {}, full_record, 0, a_ostream);
+                // now print out records
+                print_overflow(full_record, a_ostream);
+                print_record("/", {}, full_record, 0, a_ostream);
 
-            // free access to all registers
-            AtomicMapper::free_all_gates();
+                // free access to all registers
+                AtomicMapper::free_all_gates();
 #endif
+            }
         }
     };
 
     template <typename Register, typename C, typename A>
     void Timer<true, Register, C, A>::print_record(const register_label_t<Register> a_record_label,
                                                    const register_record_t<Register> &a_record,
-                                                   const Register &a_register,
+                                                   const record_register_t &a_register,
                                                    const unsigned a_level,
                                                    std::ostream &a_ostream)
     {
         // declare static root Timer set to zero-level Timer's
         static std::pair<register_label_t<Register>, register_record_t<Register>> root;
 
+        // throughput columns are printed only when some of the nested scopes processed work
+        bool show_work{false};
+
         // fat lambda that helps printing individual measurements
-        auto prnt_rec = [&a_ostream, a_level](const auto name, const auto rec, const auto es_count) {
+        // a_t_items and a_t_bytes, if given, are the times work rates refer to instead of the scope's
+        auto prnt_rec = [&a_ostream, a_level, &show_work](const auto name, const auto rec, const auto es_count,
+                                                          const double a_t_items = 0, const double a_t_bytes = 0) {
             // useful scope and constants
             using namespace std::string_literals;
             constexpr auto tabsize{3};
@@ -413,6 +1243,28 @@ namespace fm::profiling {
                           << std::setw(DFW) << std::scientific << std::setprecision(3) << rec._duration.count() << tab
                           << std::setw(PFW) << std::scientific << std::setprecision(2) << rec._duration.count() / es_count << tab
                           << std::setw(RFW) << rec._duration.count() / root.second._duration.count();
+                if (show_work)
+                {
+                    // work rates, or a dash if no such work was recorded
+                    auto prnt_rate = [&](const auto a_work, const auto a_rate) {
+                        a_ostream << tab << std::setw(PFW);
+                        if (a_work > 0)
+                            a_ostream << a_rate;
+                        else
+                            a_ostream << _cnt_string(PFW, "-"s);
+                    };
+                    const auto t = rec._duration.count();
+                    const auto t_items = a_t_items > 0 ? a_t_items : t;
+                    const auto t_bytes = a_t_bytes > 0 ? a_t_bytes : t;
+                    const auto &[items, bytes] = rec._work;
+                    prnt_rate(items, items / t_items);
+                    prnt_rate(bytes, bytes / t_bytes);
+                    prnt_rate(items, 1e9 * t_items / items);
+                }
+                if constexpr (TimerBudgets)
+                {
+                    a_ostream << tab << std::setw(PFW) << _cnt_string(PFW, std::to_string(rec._overruns));
+                }
                 if constexpr (TimerStats)
                 {
                     if (name != "total")
@@ -430,7 +1282,23 @@ namespace fm::profiling {
             {
                 a_ostream << std::string(CW, '=') << "\n"
                           << name << ": call-cnt: " << rec._count
-                          << ", time: " << std::scientific << rec._duration.count() << " s\n"
+                          << ", time: " << std::scientific << rec._duration.count() << " s";
+
+                // work rates of this scope, if any
+                const auto t = rec._duration.count();
+                const auto &[items, bytes] = rec._work;
+                if (items > 0)
+                    a_ostream << ", items/s: " << std::setprecision(2) << items / t;
+                if (bytes > 0)
+                    a_ostream << ", bytes/s: " << std::setprecision(2) << bytes / t;
+                if (items > 0)
+                    a_ostream << ", ns/item: " << std::setprecision(2) << 1e9 * t / items;
+                if constexpr (TimerBudgets)
+                {
+                    if (rec._overruns > 0)
+                        a_ostream << ", overruns: " << rec._overruns;
+                }
+                a_ostream << "\n"
                           << std::string(CW, '-') << "\n";
 
                 // this avoids printing out headers for one entry case
@@ -440,6 +1308,16 @@ namespace fm::profiling {
                               << _cnt_string(NFW, "name"s) << tab << _cnt_string(PFW, "call-cnt"s) << tab << _cnt_string(DFW, "t[s]"s) << tab
                               << _cnt_string(PFW, "t/t_en-scp"s) << tab << _cnt_string(RFW, "t/t_" + root.first);
 
+                    if (show_work)
+                    {
+                        a_ostream << tab << _cnt_string(PFW, "items/s"s) << tab << _cnt_string(PFW, "bytes/s"s)
+                                  << tab << _cnt_string(PFW, "ns/item"s);
+                    }
+                    if constexpr (TimerBudgets)
+                    {
+                        a_ostream << tab << _cnt_string(PFW, "overruns"s);
+                    }
+
                     if constexpr (TimerStats)
                     {
                         a_ostream << tab << _cnt_string(PFW, "t[s]/cnt"s) << tab << _cnt_string(PFW, "t_rms[s]"s)
@@ -450,11 +1328,74 @@ namespace fm::profiling {
             }
         };
 
+        // print out the slowest calls of a scope, slowest first
+        auto prnt_xmp = [&a_ostream, a_level](const auto name, const auto &rec) {
+            if constexpr (TimerExemplars > 0)
+            {
+                if (rec._exemplars.empty())
+                    return;
+
+                constexpr auto tabsize{3};
+                const std::string indent((a_level + 1) * tabsize, ' ');
+
+                auto exemplars{rec._exemplars};
+                std::sort_heap(exemplars.begin(), exemplars.end());
+
+                a_ostream << std::string(indent.size() - tabsize, ' ') << "slowest calls of " << name << ":\n";
+                for (const auto &[dt, t_start, thread, tag] : exemplars)
+                {
+                    a_ostream << indent << std::scientific << std::setprecision(3) << dt.count() << " s"
+                              << ", start: t0+" << t_start.count() << " s, thread: " << thread;
+                    if (tag.size())
+                        a_ostream << ", tag: " << tag;
+                    a_ostream << "\n";
+                }
+            }
+        };
+
+        // print out calls folded into a recursive scope by recursion depth
+        auto prnt_rcr = [&a_ostream, a_level](const auto name, const auto &rec) {
+            if constexpr (TimerFoldRecursion)
+            {
+                const auto &calls = rec._recursion._calls;
+                if (calls.empty())
+                    return;
+
+                constexpr auto tabsize{3};
+                a_ostream << std::string(a_level * tabsize, ' ') << "folded recursive calls of " << name << " by depth:";
+                for (size_t d{0}; d < calls.size(); ++d)
+                    a_ostream << " " << d + 1 << ":" << calls[d];
+                a_ostream << "\n";
+            }
+        };
+
+        // true if a scope has more to show than its count and time
+        auto has_details = [](const auto &rec) {
+            auto details = rec._work._items > 0 || rec._work._bytes > 0;
+            if constexpr (TimerBudgets)
+                details = details || rec._overruns > 0;
+            if constexpr (TimerExemplars > 0)
+                details = details || !rec._exemplars.empty();
+            if constexpr (TimerFoldRecursion)
+                details = details || !rec._recursion._calls.empty();
+            return details;
+        };
+
+        // true if the scope labeled a_label has no nested scopes
+        auto is_leaf = [&a_register](const auto &a_label) {
+            return std::none_of(a_register.cbegin(), a_register.cend(), [&a_label](const auto &entry) {
+                return entry.first.size() > a_label.size() &&
+                       entry.first.compare(0, a_label.size(), a_label) == 0 && entry.first[a_label.size()] == '/';
+            });
+        };
+
         // special case of only one entry
         if (a_register.size() == 1)
         {
             const auto &[name, record] = *a_register.cbegin();
             prnt_rec(name, record, -1);
+            prnt_xmp(name, record);
+            prnt_rcr(name, record);
         }
         // time-record of labeled scope
         else
@@ -475,20 +1416,59 @@ namespace fm::profiling {
             std::sort(nested_records.begin(), nested_records.end(),
                       [](const auto &a, const auto &b) { return a.second._duration > b.second._duration; });
 
+            show_work = std::any_of(nested_records.cbegin(), nested_records.cend(), [](const auto &nested) {
+                return nested.second._work._items > 0 || nested.second._work._bytes > 0;
+            });
+
             if (a_record._count > 0 && nested_records.size() > 0)
             {
                 // print only if record exists and contains other timers
                 prnt_rec(a_record_label.substr(0, a_record_label.size() - 2), a_record, 0);
 
                 // print finer timer-mesurementes and total
+                // total work rates refer to the time of the nested scopes processing such work
                 register_record_t<Register> total{};
+                double t_items{0}, t_bytes{0};
                 for (const auto &[name, subrec] : nested_records)
                 {
                     prnt_rec(name, subrec, a_record._duration.count());
                     total._count += subrec._count;
                     total._duration += subrec._duration;
+                    total._work._items += subrec._work._items;
+                    total._work._bytes += subrec._work._bytes;
+                    if (subrec._work._items > 0)
+                        t_items += subrec._duration.count();
+                    if (subrec._work._bytes > 0)
+                        t_bytes += subrec._duration.count();
+                    if constexpr (TimerBudgets)
+                        total._overruns += subrec._overruns;
+                }
+                prnt_rec("total", total, a_record._duration.count(), t_items, t_bytes);
+
+                // exemplars and recursion of this scope and of nested scopes without their own section
+                if constexpr (TimerExemplars > 0 || TimerFoldRecursion)
+                {
+                    prnt_xmp(a_record_label.substr(0, a_record_label.size() - 1), a_record);
+                    prnt_rcr(a_record_label.substr(0, a_record_label.size() - 1), a_record);
+                    for (const auto &[name, subrec] : nested_records)
+                    {
+                        if (is_leaf(a_record_label + name))
+                        {
+                            prnt_xmp(name, subrec);
+                            prnt_rcr(name, subrec);
+                        }
+                    }
                 }
-                prnt_rec("total", total, a_record._duration.count());
+            }
+            // top-level scopes without nested ones have no enclosing section to show their details,
+            // nor has the top-level overflow entry of the shared register to show its calls
+            else if (a_level == 1 && a_record._count > 0 &&
+                     (has_details(a_record) || a_record_label == _overflow_label + "/"))
+            {
+                const auto name = a_record_label.substr(0, a_record_label.size() - 1);
+                prnt_rec(name, a_record, -1);
+                prnt_xmp(name, a_record);
+                prnt_rcr(name, a_record);
             }
 
             // analyse nested-timers
@@ -506,10 +1486,49 @@ namespace fm::profiling {
     // define static variables
     template <typename T, typename C, typename A>
     thread_local register_label_t<T> Timer<true, T, C, A>::_call_sequence{};
-#ifndef MULTI_THREAD
+
+    template <typename T, typename C, typename A>
+    const register_label_t<T> Timer<true, T, C, A>::_overflow_label{"/~overflow"};
+
+    template <typename T, typename C, typename A>
+    const std::chrono::time_point<C> Timer<true, T, C, A>::_t_origin{C::now()};
+
+#ifdef TIMER_BUDGETS
+    template <typename T, typename C, typename A>
+    LockFreeQueue<typename Timer<true, T, C, A>::overrun_event_t> Timer<true, T, C, A>::_overruns{};
+
+    template <typename T, typename C, typename A>
+    std::atomic<size_t> Timer<true, T, C, A>::_overruns_lost{0};
+
+    template <typename T, typename C, typename A>
+    std::array<WatchSlot<register_label_t<T>, typename C::rep>, Timer<true, T, C, A>::WatchSlotCount>
+        Timer<true, T, C, A>::_watch_slots{};
+
+    template <typename T, typename C, typename A>
+    std::jthread Timer<true, T, C, A>::_watchdog{};
+#endif
+
     template <typename T, typename C, typename A>
     T Timer<true, T, C, A>::_register{};
-#else
+
+    template <typename L, size_t N, typename H>
+    std::array<typename AtomicInterner<L, N, H>::slot, 2 * N> AtomicInterner<L, N, H>::_slots{};
+
+    template <typename L, size_t N, typename H>
+    std::array<std::atomic<const L *>, N> AtomicInterner<L, N, H>::_labels{};
+
+    template <typename L, size_t N, typename H>
+    std::atomic<size_t> AtomicInterner<L, N, H>::_size{0};
+
+    template <typename L, size_t N, typename H>
+    const L AtomicInterner<L, N, H>::_overflow_label{"/~overflow"};
+
+    template <typename R, size_t N, unsigned S>
+    std::atomic<unsigned> SharedTimeRegister<R, N, S>::_thread_count{0};
+
+    template <typename R, size_t N, unsigned S>
+    thread_local unsigned SharedTimeRegister<R, N, S>::_stripe{_thread_count++ % S};
+#ifdef MULTI_THREAD
     template <typename T, typename C, typename A>
     std::vector<T> Timer<true, T, C, A>::_registers{};
 
@@ -519,6 +1538,12 @@ namespace fm::profiling {
     template <typename T, typename C, typename A>
     thread_local unsigned Timer<true, T, C, A>::_thread_timer_cnt{0};
 
+    template <typename T, typename C, typename A>
+    std::atomic<unsigned> Timer<true, T, C, A>::_thread_count{0};
+
+    template <typename T, typename C, typename A>
+    thread_local unsigned Timer<true, T, C, A>::_thread_index{_thread_count++};
+
     template <typename K, typename H>
     std::vector<typename AtomicGates<K, H>::atomic_gate> AtomicGates<K, H>::_gates{};
 
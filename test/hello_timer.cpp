@@ -50,8 +50,11 @@ int main(int argc, char *argv[])
     Timer_t<>::set_thread_count(n_threads);
 #endif
 
+    Timer_t<>::start_watchdog(0.2ms);
+
     Timer_t<> tmr("main");
     std::string timer_prefix{};
+    std::string loop_tag{};
 
     auto timering = [&s = timer_prefix]() {
         Timer_t<2> t{s + "hello"};
@@ -61,12 +64,13 @@ int main(int argc, char *argv[])
         {
             Timer_t<3> t{"indent"}; //std::this_thread::sleep_for(0.5ms);
             {
-                Timer_t<4> t{"++dent"};
+                Timer_t<4> t{"++dent", 1500, 12000};
                 std::this_thread::sleep_for(1.5ms);
             }
             {
                 Timer_t<4> t{"++bent"};
                 std::this_thread::sleep_for(0.3ms);
+                t.add_work(300);
             }
             {
                 Timer_t<4> t{"++bore"}; //std::this_thread::sleep_for(0.2ms);
@@ -79,14 +83,14 @@ int main(int argc, char *argv[])
         {
             Timer_t<3> t{"postdent"}; //std::this_thread::sleep_for(1.2ms);
             {
-                Timer_t<2> t{"inpost"};
+                Timer_t<2> t{"inpost", 1ms};
                 std::this_thread::sleep_for(2ms);
             }
         }
     };
-    auto timering_more = [&s = timer_prefix]() {
+    auto timering_more = [&s = timer_prefix, &l = loop_tag]() {
         {
-            Timer_t<2> t{s + "posthello"}; //std::this_thread::sleep_for(1.1ms);
+            Timer_t<2> t{s + "posthello", l}; //std::this_thread::sleep_for(1.1ms);
             {
                 Timer_t<3> t{"phindent"};
                 std::this_thread::sleep_for(1ms);
@@ -98,8 +102,17 @@ int main(int argc, char *argv[])
         }
     };
 
+    std::function<void(int)> timering_recursive = [&](int depth) {
+        Timer_t<2> t{"recursive"};
+        std::this_thread::sleep_for(0.1ms);
+        if (depth > 0)
+            timering_recursive(depth - 1);
+    };
+
     for (auto i{0}; i < n_loops; ++i)
     {
+        timering_recursive(3);
+        loop_tag = "loop-" + std::to_string(i);
 
         timering();
 
@@ -126,6 +139,8 @@ int main(int argc, char *argv[])
     }
 
     tmr.stop();
+    Timer_t<>::stop_watchdog();
+    Timer_t<>::print_overruns();
     if (filename.size())
     {
         std::fstream file("timer.txt", std::ios_base::out | std::ios_base::trunc);
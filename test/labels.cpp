@@ -0,0 +1,63 @@
+// Test the cap on distinct labels per register with many dynamically named scopes
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cstring>
+#include <cassert>
+#ifndef TIMER_MAX_LABELS
+#define TIMER_MAX_LABELS 8
+#endif
+#include "Timer.h"
+
+int main(int argc, char *argv[])
+{
+    using namespace fm::profiling;
+
+    std::cout << "Hello labels!\n";
+    const std::string prog(argv[0]);
+
+    int n_labels{0};
+    for (auto i{0}; i < argc; ++i)
+        if (strncmp(argv[i], "-nl", 3) == 0)
+            n_labels = std::stoi(argv[i + 1]);
+
+    if (n_labels <= 0)
+    {
+        std::cout << "\n number of labels=" << n_labels
+                  << ".\n Run this prog with: " + prog + " -nl num_labels\n\n";
+        return 0;
+    }
+
+#ifdef MULTI_THREAD
+    Timer_t<>::set_thread_count(1);
+#endif
+
+    Timer_t<> tmr("main");
+    for (auto i{0}; i < n_labels; ++i)
+    {
+        Timer_t<> t{"scope_" + std::to_string(i)};
+        {
+            Timer_t<> t{"inner"};
+        }
+    }
+    tmr.stop();
+
+    std::ostringstream out;
+    Timer_t<>::print_record(out);
+    std::cout << out.str();
+
+#ifdef USE_TIMER
+    // enclosing scopes keep their entry, labels past the cap end up in their parent's overflow entry
+    const auto report{out.str()};
+    assert(report.find("scope_0") != std::string::npos);
+    if (n_labels > TIMER_MAX_LABELS)
+    {
+        assert(report.find("warning: register label cap") != std::string::npos);
+        assert(report.find("~overflow") != std::string::npos);
+        assert(report.find("scope_" + std::to_string(n_labels - 1)) == std::string::npos);
+    }
+#endif
+
+    return 0;
+}
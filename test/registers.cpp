@@ -0,0 +1,117 @@
+// Benchmark per-thread registers against the shared register with many short-lived threads
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <iomanip>
+#include "Timer.h"
+
+using Clock = std::chrono::steady_clock;
+
+// a short-lived thread timing a handful of scopes n_loops times
+template <typename T>
+void short_task(const int n_loops)
+{
+    for (auto l{0}; l < n_loops; ++l)
+    {
+        T t{"task"};
+        {
+            T t{"read"};
+        }
+        {
+            T t{"compute"};
+            {
+                T t{"kernel"};
+            }
+        }
+        {
+            T t{"write"};
+        }
+    }
+}
+
+// run n_spawns short-lived threads, at most n_threads at a time, then print out records:
+// return recording and printing times
+template <typename T>
+auto run(const int n_threads, const int n_spawns, const int n_loops)
+{
+    std::chrono::duration<double, std::milli> t_record, t_print;
+
+    const auto t_i{Clock::now()};
+    for (auto spawned{0}; spawned < n_spawns;)
+    {
+        std::vector<std::thread> ts;
+        for (auto i{0}; i < n_threads && spawned < n_spawns; ++i, ++spawned)
+            ts.emplace_back(short_task<T>, n_loops);
+        for (auto &t : ts)
+            t.join();
+    }
+    const auto t_m{Clock::now()};
+    std::ofstream dummy("/dev/null");
+    T::print_record(dummy);
+    const auto t_e{Clock::now()};
+
+    t_record = t_m - t_i;
+    t_print = t_e - t_m;
+    return std::make_pair(t_record, t_print);
+}
+
+int main([[maybe_unused]] int argc, char *argv[])
+{
+    using namespace fm::profiling;
+
+    std::cout << "Hello Register Benchmark!\n";
+    const std::string prog(argv[0]);
+
+#if !defined(USE_TIMER) || !defined(MULTI_THREAD)
+    std::cout << "\n compile with -DUSE_TIMER -DMULTI_THREAD to compare registers\n\n";
+    return 0;
+#else
+    int n_threads{0}, n_spawns{0}, n_loops{100};
+    for (auto i{0}; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-nt", 3) == 0)
+            n_threads = std::stoi(argv[i + 1]);
+        if (strncmp(argv[i], "-ns", 3) == 0)
+            n_spawns = std::stoi(argv[i + 1]);
+        if (strncmp(argv[i], "-nl", 3) == 0)
+            n_loops = std::stoi(argv[i + 1]);
+    }
+
+    if (n_threads <= 0 || n_spawns <= 0 || n_loops <= 0)
+    {
+        std::cout << "\n max thread count=" << n_threads << ", number of spawned threads=" << n_spawns
+                  << " and number of loops=" << n_loops << ".\n"
+                  << " Run this prog with: " + prog + " -nt max_threads -ns num_spawned_threads [-nl num_loops]\n\n";
+        return 0;
+    }
+
+    Timer_t<>::set_thread_count(n_threads);
+
+    // off duty Timers: the baseline run times thread creation and joining alone
+    using NoTimer = Timer<false, TimeRegister<>, Clock, AtomicGates<>>;
+    const double n_scopes = 5.0 * n_spawns * n_loops;
+
+    std::cout << "\n " << n_spawns << " short-lived threads per run timing " << 5 * n_loops << " scopes each\n"
+              << " baseline without timers in ms, recording overhead over baseline in ns per scope,"
+              << " printing in ms\n\n"
+              << std::setw(10) << "threads" << std::setw(14) << "baseline" << std::setw(14) << "per-thr rec"
+              << std::setw(14) << "per-thr prt" << std::setw(14) << "shared rec" << std::setw(14) << "shared prt"
+              << "\n";
+
+    for (auto nt{1}; nt <= n_threads; nt *= 2)
+    {
+        const auto [b_rec, b_prt] = run<NoTimer>(nt, n_spawns, n_loops);
+        const auto [t_rec, t_prt] = run<Timer_t<>>(nt, n_spawns, n_loops);
+        const auto [s_rec, s_prt] = run<SharedTimer_t<>>(nt, n_spawns, n_loops);
+        std::cout << std::setw(10) << nt << std::fixed << std::setprecision(3) << std::setw(14) << b_rec.count()
+                  << std::setw(14) << (t_rec - b_rec).count() * 1e6 / n_scopes << std::setw(14) << t_prt.count()
+                  << std::setw(14) << (s_rec - b_rec).count() * 1e6 / n_scopes << std::setw(14) << s_prt.count()
+                  << "\n";
+    }
+    std::cout << "\n";
+#endif
+}